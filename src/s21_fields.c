@@ -0,0 +1,334 @@
+#include "s21_fields.h"
+
+#define S21_FIELDS_BLOCK 64u
+#define S21_READER_BUF 65536u
+
+/* helper: index of the lowest set bit (m != 0) */
+static unsigned s21_ctz64(unsigned long long m) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctzll(m);
+#else
+    unsigned n = 0;
+    while (!(m & 1ull)) {
+        m >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+/* helper: bit i of the result is the XOR of bits 0..i of x. Applied to the
+   quote bitmap this marks every byte from an opening quote up to (not
+   including) the matching closing quote, in six shifts instead of a
+   byte-by-byte state machine. */
+static unsigned long long s21_prefix_xor(unsigned long long x) {
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+/* helper: load 8 bytes so that p[i] lands in bits 8*i..8*i+7 */
+static unsigned long long s21_load8(const char* p) {
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    unsigned long long w;
+    __builtin_memcpy(&w, p, 8);
+    return w;
+#else
+    unsigned long long w = 0;
+    for (unsigned i = 0; i < 8; ++i) w |= (unsigned long long)(unsigned char)p[i] << (8 * i);
+    return w;
+#endif
+}
+
+/* helper: SWAR compare of 8 bytes against the byte repeated in pattern.
+   Bit i of the result is set when byte i of w equals it. The zero-byte
+   test is the exact form (no false positives from borrows), and the
+   multiply gathers the eight 0x80 flags into the top byte. */
+static unsigned s21_eq8(unsigned long long w, unsigned long long pattern) {
+    const unsigned long long low7 = 0x7F7F7F7F7F7F7F7Full;
+    unsigned long long x = w ^ pattern;
+    unsigned long long zero = ~(((x & low7) + low7) | x | low7);
+    return (unsigned)(((zero >> 7) * 0x0102040810204080ull) >> 56);
+}
+
+/* helper: classify up to 64 bytes of p into bitmaps and return the
+   delimiters that are outside quotes. Unquoted newlines go to *newlines,
+   all quotes to *quote_bits (fields without one skip s21_unquote).
+   *carry is all ones when the block starts inside quotes and is updated
+   for the next block. Whole 8-byte words are compared with s21_eq8, the
+   tail of a short block byte by byte. */
+static unsigned long long s21_block_mask(const char* p, size_t n, char delim, unsigned long long* carry,
+                                         unsigned long long* newlines, unsigned long long* quote_bits) {
+    const unsigned long long ones = 0x0101010101010101ull;
+    const unsigned long long qpat = ones * (unsigned char)'"';
+    const unsigned long long dpat = ones * (unsigned char)delim;
+    const unsigned long long lpat = ones * (unsigned char)'\n';
+    unsigned long long quotes = 0, delims = 0, lines = 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        unsigned long long w = s21_load8(p + i);
+        quotes |= (unsigned long long)s21_eq8(w, qpat) << i;
+        delims |= (unsigned long long)s21_eq8(w, dpat) << i;
+        lines |= (unsigned long long)s21_eq8(w, lpat) << i;
+    }
+    for (; i < n; ++i) {
+        unsigned long long bit = 1ull << i;
+        quotes |= (p[i] == '"') ? bit : 0;
+        delims |= (p[i] == delim) ? bit : 0;
+        lines |= (p[i] == '\n') ? bit : 0;
+    }
+    unsigned long long inside = s21_prefix_xor(quotes) ^ *carry;
+    *carry = 0ull - (inside >> 63);
+    *newlines = lines & ~inside;
+    *quote_bits = quotes;
+    return delims & ~inside;
+}
+
+/* helper: remove quoting in place, matching the block scan: every '"'
+   toggles quoting, and "" inside quotes stands for one literal quote.
+   Fields without quotes are returned untouched. Returns the new length. */
+static size_t s21_unquote(char* s, size_t len) {
+    size_t w = 0;
+    while (w < len && s[w] != '"') ++w;
+    if (w == len) return len;
+    int in_quotes = 0;
+    for (size_t r = w; r < len; ++r) {
+        if (s[r] != '"') {
+            s[w++] = s[r];
+        } else if (in_quotes && r + 1 < len && s[r + 1] == '"') {
+            s[w++] = '"';
+            ++r;
+        } else {
+            in_quotes = !in_quotes;
+        }
+    }
+    return w;
+}
+
+/* helper: bits of m at or below the single set bit `bit` */
+static unsigned long long s21_upto(unsigned long long m, unsigned long long bit) {
+    return m & (bit | (bit - 1));
+}
+
+/* helper: finish field [from, to) of record: unquote if it holds a quote,
+   terminate, store */
+static void s21_emit_field(char* record, size_t from, size_t to, int quoted, s21_field* fields,
+                           size_t max_fields, size_t idx) {
+    size_t len = quoted ? s21_unquote(record + from, to - from) : to - from;
+    record[from + len] = '\0';
+    if (idx < max_fields) {
+        fields[idx].str = record + from;
+        fields[idx].len = len;
+    }
+}
+
+/* s21_split_record: split one record (without its '\n') into fields.
+   - record[len] must be writable: it receives the last field's '\0'.
+   - Delimiters and quotes are modified in place, as in s21_strtok.
+   - Empty fields are kept: "a,,b" gives 3 fields, "" gives 1 empty field.
+   - A trailing '\r' (CRLF input) is dropped.
+   - Returns the total number of fields; only the first max_fields are
+     stored in fields, so callers can size the array and retry.
+   - Returns 0 if record is NULL or delim is '"'. */
+size_t s21_split_record(char* record, size_t len, char delim, s21_field* fields, size_t max_fields) {
+    if (!record || delim == '"') return 0;
+    size_t count = 0;
+    size_t from = 0;
+    int quoted = 0;
+    unsigned long long carry = 0;
+    for (size_t base = 0; base < len; base += S21_FIELDS_BLOCK) {
+        size_t n = len - base < S21_FIELDS_BLOCK ? len - base : S21_FIELDS_BLOCK;
+        unsigned long long newlines, quotes;
+        unsigned long long m = s21_block_mask(record + base, n, delim, &carry, &newlines, &quotes);
+        for (; m; m &= m - 1) {
+            unsigned long long bit = m & (0ull - m);
+            size_t at = base + s21_ctz64(m);
+            quoted |= s21_upto(quotes, bit) != 0;
+            quotes &= ~s21_upto(quotes, bit);
+            s21_emit_field(record, from, at, quoted, fields, max_fields, count++);
+            from = at + 1;
+            quoted = 0;
+        }
+        quoted |= quotes != 0;
+    }
+    size_t to = len;
+    if (to > from && record[to - 1] == '\r') --to;
+    s21_emit_field(record, from, to, quoted, fields, max_fields, count++);
+    return count;
+}
+
+/* s21_reader_init: prepare rd to read records separated by '\n' from in.
+   Returns 0 on success, -1 on bad arguments or allocation failure. */
+int s21_reader_init(s21_record_reader* rd, FILE* in, char delim) {
+    if (!rd) return -1;
+    rd->in = in;
+    rd->buf = NULL;
+    rd->cap = S21_READER_BUF;
+    rd->start = 0;
+    rd->end = 0;
+    rd->scanned = 0;
+    rd->block = 0;
+    rd->pending = 0;
+    rd->newlines = 0;
+    rd->quotes = 0;
+    rd->quoted = 0;
+    rd->carry = 0;
+    rd->classified = 0;
+    rd->eof = 0;
+    rd->error = 0;
+    rd->delim = delim;
+    rd->fields = NULL;
+    rd->quoted_marks = NULL;
+    rd->nfields = 0;
+    rd->fields_cap = 0;
+    if (!in || delim == '"' || delim == '\n') return -1;
+    rd->buf = (char*)malloc(rd->cap);
+    if (!rd->buf) return -1;
+    return 0;
+}
+
+/* helper: move the unread tail to the front, grow the buffer if the
+   current record fills it, and read more input. One byte is always kept
+   free after the data so the last field of the file can be terminated.
+   Field offsets are relative to the record start and survive the move. */
+static void s21_reader_fill(s21_record_reader* rd) {
+    if (rd->start > 0) {
+        size_t n = rd->end - rd->start;
+        for (size_t i = 0; i < n; ++i) rd->buf[i] = rd->buf[rd->start + i];
+        rd->scanned -= rd->start;
+        rd->start = 0;
+        rd->end = n;
+    }
+    if (rd->end + 1 >= rd->cap) {
+        char* grown = (char*)realloc(rd->buf, rd->cap * 2);
+        if (!grown) {
+            rd->error = 1;
+            rd->eof = 1;
+            return;
+        }
+        rd->buf = grown;
+        rd->cap *= 2;
+    }
+    size_t got = fread(rd->buf + rd->end, 1, rd->cap - 1 - rd->end, rd->in);
+    rd->end += got;
+    if (got == 0) {
+        rd->eof = 1;
+        if (ferror(rd->in)) rd->error = 1;
+    }
+}
+
+/* helper: remember a field boundary at offset off from the record start
+   and whether the field holds a quote */
+static int s21_reader_push(s21_record_reader* rd, size_t off, int quoted) {
+    if (rd->nfields == rd->fields_cap) {
+        size_t cap = rd->fields_cap ? rd->fields_cap * 2 : 16;
+        s21_field* grown = (s21_field*)realloc(rd->fields, cap * sizeof(s21_field));
+        if (grown) rd->fields = grown;
+        unsigned char* marks = grown ? (unsigned char*)realloc(rd->quoted_marks, cap) : NULL;
+        if (!marks) {
+            rd->error = 1;
+            return -1;
+        }
+        rd->quoted_marks = marks;
+        rd->fields_cap = cap;
+    }
+    rd->fields[rd->nfields].str = NULL;
+    rd->fields[rd->nfields].len = off;
+    rd->quoted_marks[rd->nfields] = (unsigned char)quoted;
+    ++rd->nfields;
+    return 0;
+}
+
+/* helper: turn the boundaries collected for the record [start, start+len)
+   into fields (last one included) and advance past the record */
+static size_t s21_reader_emit(s21_record_reader* rd, size_t len, s21_field** fields) {
+    if (s21_reader_push(rd, len, rd->quoted) != 0) return 0;
+    rd->quoted = 0;
+    char* rec = rd->buf + rd->start;
+    size_t count = rd->nfields;
+    size_t from = 0;
+    for (size_t i = 0; i < count; ++i) {
+        size_t to = rd->fields[i].len;
+        int quoted = rd->quoted_marks[i];
+        size_t next = to + 1;
+        if (i + 1 == count && to > from && rec[to - 1] == '\r') --to;
+        s21_emit_field(rec, from, to, quoted, rd->fields, count, i);
+        from = next;
+    }
+    rd->start += len + 1;
+    if (rd->start > rd->end) rd->start = rd->end;
+    rd->nfields = 0;
+    *fields = rd->fields;
+    return count;
+}
+
+/* s21_reader_next: read the next record and split it into fields.
+   - *fields points to an array owned by rd; it and the field strings stay
+     valid until the next call.
+   - Delimiter and newline positions come from one quote-aware block scan.
+     Bits past the end of a record stay pending for the next call, so no
+     byte is classified twice and records are not split a second time.
+   - Returns the number of fields, or 0 at end of input or on error
+     (rd->error tells them apart). */
+size_t s21_reader_next(s21_record_reader* rd, s21_field** fields) {
+    if (!rd || !rd->buf || !fields || rd->error) return 0;
+    for (;;) {
+        /* locals: stores into the char buffer could alias rd's fields */
+        unsigned long long pending = rd->pending;
+        unsigned long long quotes = rd->quotes;
+        const unsigned long long newlines = rd->newlines;
+        const size_t base = rd->block - rd->start;
+        int quoted = rd->quoted;
+        for (; pending; pending &= pending - 1) {
+            unsigned long long bit = pending & (0ull - pending);
+            size_t off = base + s21_ctz64(pending);
+            quoted |= s21_upto(quotes, bit) != 0;
+            quotes &= ~s21_upto(quotes, bit);
+            if (newlines & bit) {
+                rd->pending = pending & (pending - 1);
+                rd->quotes = quotes;
+                rd->quoted = quoted;
+                return s21_reader_emit(rd, off, fields);
+            }
+            if (s21_reader_push(rd, off, quoted) != 0) return 0;
+            quoted = 0;
+        }
+        rd->pending = 0;
+        rd->quotes = 0;
+        rd->quoted = quoted || quotes != 0;
+        if (rd->scanned < rd->end) {
+            size_t n = rd->end - rd->scanned;
+            if (n > S21_FIELDS_BLOCK) n = S21_FIELDS_BLOCK;
+            rd->block = rd->scanned;
+            rd->pending =
+                s21_block_mask(rd->buf + rd->block, n, rd->delim, &rd->carry, &rd->newlines, &rd->quotes);
+            rd->pending |= rd->newlines;
+            rd->scanned += n;
+            rd->classified += n;
+            continue;
+        }
+        if (rd->eof) {
+            if (rd->start == rd->end) return 0;
+            /* last record without a trailing newline */
+            return s21_reader_emit(rd, rd->end - rd->start, fields);
+        }
+        s21_reader_fill(rd);
+        if (rd->error) return 0;
+    }
+}
+
+/* s21_reader_free: release buffers (does not close the stream). */
+void s21_reader_free(s21_record_reader* rd) {
+    if (!rd) return;
+    free(rd->buf);
+    free(rd->fields);
+    free(rd->quoted_marks);
+    rd->buf = NULL;
+    rd->fields = NULL;
+    rd->quoted_marks = NULL;
+    rd->fields_cap = 0;
+}
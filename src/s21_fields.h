@@ -0,0 +1,59 @@
+#ifndef S21_FIELDS_H
+#define S21_FIELDS_H
+
+#include <stdio.h>  /* for FILE (permitted) */
+#include <stdlib.h> /* for size_t (permitted) */
+
+/* Record-oriented field splitter for delimited text (CSV, TSV, logs).
+   Unlike s21_strtok it keeps empty fields and understands RFC 4180 style
+   quoting ("a,b" is one field, "" inside quotes is a literal quote).
+   Every '"' toggles quoting, so quote state for a whole 64-byte block is
+   one prefix XOR of its quote bitmap.
+   Like s21_strtok it works in place: fields are views into the caller's
+   (or the reader's) buffer, each terminated by '\0'. */
+
+typedef struct {
+    char* str;  /* field text, '\0'-terminated, quotes removed */
+    size_t len; /* length of str */
+} s21_field;
+
+/* Block-buffered reader yielding one record (line) at a time. Newlines
+   inside quoted fields do not end a record. Input is classified in blocks
+   of up to 64 bytes; a block's bitmaps are kept across records, so every
+   byte goes through the classifier exactly once. */
+typedef struct {
+    FILE* in;
+    char* buf;
+    size_t cap;
+    size_t start;                /* first byte of the current record */
+    size_t end;                  /* end of buffered data */
+    size_t scanned;              /* end of classified data (start <= scanned <= end) */
+    size_t block;                /* offset of the block the bitmaps below describe */
+    unsigned long long pending;  /* unconsumed unquoted delimiters/newlines */
+    unsigned long long newlines; /* which pending bits are newlines */
+    unsigned long long quotes;   /* quote bits of the block not yet consumed */
+    int quoted;                  /* current field holds a quote */
+    unsigned long long carry;    /* quote state at scanned */
+    size_t classified;           /* bytes run through the classifier */
+    int eof;
+    int error;
+    char delim;
+    s21_field* fields;           /* while scanning: .len holds delimiter offsets */
+    unsigned char* quoted_marks; /* per field: holds a quote (same capacity) */
+    size_t nfields;
+    size_t fields_cap;
+} s21_record_reader;
+
+/* Declaration of s21_split_record */
+size_t s21_split_record(char* record, size_t len, char delim, s21_field* fields, size_t max_fields);
+
+/* Declaration of s21_reader_init */
+int s21_reader_init(s21_record_reader* rd, FILE* in, char delim);
+
+/* Declaration of s21_reader_next */
+size_t s21_reader_next(s21_record_reader* rd, s21_field** fields);
+
+/* Declaration of s21_reader_free */
+void s21_reader_free(s21_record_reader* rd);
+
+#endif /* S21_FIELDS_H */
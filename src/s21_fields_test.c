@@ -0,0 +1,180 @@
+#include "s21_fields.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "s21_string.h"
+
+/* helper: print fields and compare them with expected (count entries) */
+static int check_fields(const s21_field* fields, size_t count, const char* const* expected,
+                        size_t expected_count) {
+    int ok = count == expected_count;
+    printf("Output: %zu fields", count);
+    for (size_t i = 0; i < count && i < expected_count; ++i) {
+        printf(" [%s]", fields[i].str);
+        if (s21_strcmp(fields[i].str, expected[i]) != 0 || fields[i].len != s21_strlen(expected[i])) ok = 0;
+    }
+    printf("\n");
+    if (ok) {
+        printf("Result: SUCCESS\n");
+    } else {
+        printf("Result: FAIL (expected %zu fields", expected_count);
+        for (size_t i = 0; i < expected_count; ++i) printf(" [%s]", expected[i]);
+        printf(")\n");
+    }
+    return ok;
+}
+
+/* s21_split_record_test: empty fields kept, quoted delimiter, escaped
+   quotes, CRLF, TSV, a record spanning several 64-byte blocks with a quote
+   across the block boundary, and abnormal arguments */
+void s21_split_record_test(void) {
+    const struct {
+        const char* in;
+        char delim;
+        const char* expect[6];
+        size_t count;
+    } tests[] = {
+        {"a,,b,", ',', {"a", "", "b", ""}, 4},                             /* empty fields kept */
+        {"", ',', {""}, 1},                                                /* empty record -> 1 empty field */
+        {"\"x,y\",z", ',', {"x,y", "z"}, 2},                               /* delimiter inside quotes */
+        {"\"say \"\"hi\"\"\",2", ',', {"say \"hi\"", "2"}, 2},             /* doubled quotes */
+        {"id,name\r", ',', {"id", "name"}, 2},                             /* CRLF line ending */
+        {"GET\t/index.html\t200", '\t', {"GET", "/index.html", "200"}, 3}, /* TSV */
+        /* quoted span crosses the 64-byte block boundary */
+        {"0123456789012345678901234567890123456789012345678901234\"56789,0123\",end", ',',
+         {"012345678901234567890123456789012345678901234567890123456789,0123", "end"}, 2},
+    };
+    const size_t num = sizeof(tests) / sizeof(tests[0]);
+
+    printf("Running s21_split_record_test (total %zu tests)\n\n", num + 2);
+    for (size_t i = 0; i < num; ++i) {
+        char buf[128];
+        s21_strcpy(buf, tests[i].in);
+        s21_field fields[6];
+        printf("Input: \"%s\"\nDelim: '%s'\n", tests[i].in, tests[i].delim == '\t' ? "\\t" : ",");
+        size_t n = s21_split_record(buf, s21_strlen(buf), tests[i].delim, fields, 6);
+        check_fields(fields, n, tests[i].expect, tests[i].count);
+        printf("\n");
+    }
+
+    /* more fields than max_fields: total count returned, first ones stored */
+    {
+        char buf[] = "1,2,3,4";
+        s21_field fields[2];
+        const char* expect[] = {"1", "2"};
+        printf("Input: \"%s\"\nDelim: ','\nmax_fields: 2\n", buf);
+        size_t n = s21_split_record(buf, s21_strlen(buf), ',', fields, 2);
+        printf("Returned: %zu\n", n);
+        if (n == 4) {
+            check_fields(fields, 2, expect, 2);
+        } else {
+            printf("Result: FAIL (expected 4)\n");
+        }
+        printf("\n");
+    }
+
+    /* abnormal: NULL record and '"' as delimiter -> 0 */
+    {
+        char buf[] = "a\"b";
+        s21_field fields[2];
+        printf("Input: NULL / delim '\"'\n");
+        size_t n1 = s21_split_record(NULL, 3, ',', fields, 2);
+        size_t n2 = s21_split_record(buf, 3, '"', fields, 2);
+        printf("Output: %zu %zu\n", n1, n2);
+        printf("Result: %s\n", (n1 == 0 && n2 == 0) ? "SUCCESS" : "FAIL");
+    }
+}
+
+/* s21_reader_next_test: records from a stream, including a quoted newline,
+   a last record without '\n', and a record larger than the read buffer */
+void s21_reader_next_test(void) {
+    printf("\nRunning s21_reader_next_test\n\n");
+
+    /* Test 1: several records, quoted newline, no trailing newline */
+    {
+        const char* text = "ts,level,msg\n1,INFO,\"multi\nline\"\n2,,\r\n3,WARN,last";
+        const char* expect[][3] = {
+            {"ts", "level", "msg"}, {"1", "INFO", "multi\nline"}, {"2", "", ""}, {"3", "WARN", "last"}};
+        FILE* f = tmpfile();
+        s21_record_reader rd;
+        int ok = f != NULL && s21_reader_init(&rd, f, ',') == 0;
+        if (ok) {
+            fputs(text, f);
+            rewind(f);
+        }
+        printf("Input: \"ts,level,msg\\n1,INFO,\\\"multi\\nline\\\"\\n2,,\\r\\n3,WARN,last\"\n");
+        s21_field* fields;
+        size_t n;
+        size_t rec = 0;
+        while (ok && (n = s21_reader_next(&rd, &fields)) > 0) {
+            printf("Record %zu:", rec);
+            for (size_t i = 0; i < n; ++i) printf(" [%s]", fields[i].str);
+            printf("\n");
+            if (rec >= 4 || n != 3) {
+                ok = 0;
+            } else {
+                for (size_t i = 0; i < n; ++i)
+                    if (s21_strcmp(fields[i].str, expect[rec][i]) != 0) ok = 0;
+            }
+            ++rec;
+        }
+        if (rec != 4 || rd.error) ok = 0;
+        /* every input byte goes through the block classifier exactly once */
+        printf("Classified: %zu of %zu bytes\n", ok ? rd.classified : 0, s21_strlen(text));
+        if (ok && rd.classified != s21_strlen(text)) ok = 0;
+        printf("Result: %s\n\n", ok ? "SUCCESS" : "FAIL");
+        if (f) {
+            s21_reader_free(&rd);
+            fclose(f);
+        }
+    }
+
+    /* Test 2: one record longer than the initial buffer, then a short one */
+    {
+        const size_t big = 200000;
+        FILE* f = tmpfile();
+        s21_record_reader rd;
+        int ok = f != NULL && s21_reader_init(&rd, f, ';') == 0;
+        if (ok) {
+            for (size_t i = 0; i < big; ++i) fputc(i % 1000 == 999 ? ';' : 'x', f);
+            fputs("\nok;done\n", f);
+            rewind(f);
+        }
+        printf("Input: %zu bytes with ';' every 1000 bytes, then \"ok;done\"\n", big);
+        s21_field* fields;
+        size_t n1 = ok ? s21_reader_next(&rd, &fields) : 0;
+        size_t len0 = n1 ? fields[0].len : 0;
+        size_t n2 = ok ? s21_reader_next(&rd, &fields) : 0;
+        int second_ok =
+            n2 == 2 && s21_strcmp(fields[0].str, "ok") == 0 && s21_strcmp(fields[1].str, "done") == 0;
+        size_t n3 = ok ? s21_reader_next(&rd, &fields) : 0;
+        printf("Output: %zu fields (first %zu bytes), then %zu fields, then %zu\n", n1, len0, n2, n3);
+        /* buffer refills and growth must not cause rescans */
+        printf("Classified: %zu of %zu bytes\n", ok ? rd.classified : 0, big + 9);
+        ok = ok && n1 == big / 1000 + 1 && len0 == 999 && second_ok && n3 == 0 && !rd.error;
+        ok = ok && rd.classified == big + 9;
+        printf("Result: %s\n\n", ok ? "SUCCESS" : "FAIL");
+        if (f) {
+            s21_reader_free(&rd);
+            fclose(f);
+        }
+    }
+
+    /* Test 3: abnormal init (NULL stream, '"' delimiter) */
+    {
+        s21_record_reader rd;
+        int r1 = s21_reader_init(&rd, NULL, ',');
+        s21_reader_free(&rd);
+        int r2 = s21_reader_init(&rd, stdin, '"');
+        s21_reader_free(&rd);
+        printf("Input: NULL stream / delim '\"'\nOutput: %d %d\n", r1, r2);
+        printf("Result: %s\n", (r1 == -1 && r2 == -1) ? "SUCCESS" : "FAIL");
+    }
+}
+
+int main(void) {
+    s21_split_record_test();
+    s21_reader_next_test();
+    return 0;
+}
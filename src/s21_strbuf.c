@@ -0,0 +1,194 @@
+#include "s21_strbuf.h"
+
+#include "s21_string.h"
+
+#define S21_STRBUF_MIN_CHUNK 256u
+#define S21_STRBUF_MIN_PIECES 16u
+
+struct s21_strbuf_chunk {
+    s21_strbuf_chunk* next;
+    size_t cap;
+    size_t used;
+    char data[];
+};
+
+/* s21_strbuf_init: set up an empty builder. No memory is allocated until
+   the first append. */
+void s21_strbuf_init(s21_strbuf* sb) {
+    if (!sb) return;
+    sb->chunks = NULL;
+    sb->pieces = NULL;
+    sb->count = 0;
+    sb->cap = 0;
+    sb->length = 0;
+    sb->error = 0;
+}
+
+/* helper: reserve n bytes of chunk storage and return where to write them.
+   A new chunk is at least twice the size of the previous one, so the
+   number of allocations grows logarithmically with the total length. */
+static char* s21_strbuf_store(s21_strbuf* sb, size_t n) {
+    s21_strbuf_chunk* c = sb->chunks;
+    if (!c || c->cap - c->used < n) {
+        size_t cap = c ? c->cap * 2 : S21_STRBUF_MIN_CHUNK;
+        if (cap < n) cap = n;
+        s21_strbuf_chunk* fresh = (s21_strbuf_chunk*)malloc(sizeof(s21_strbuf_chunk) + cap);
+        if (!fresh) return NULL;
+        fresh->next = c;
+        fresh->cap = cap;
+        fresh->used = 0;
+        sb->chunks = fresh;
+        c = fresh;
+    }
+    char* dst = c->data + c->used;
+    c->used += n;
+    return dst;
+}
+
+/* helper: insert a piece descriptor at index idx, growing the table by
+   doubling. Returns 0 on success, -1 on allocation failure. */
+static int s21_strbuf_push_piece(s21_strbuf* sb, size_t idx, const char* data, size_t len) {
+    if (sb->count == sb->cap) {
+        size_t cap = sb->cap ? sb->cap * 2 : S21_STRBUF_MIN_PIECES;
+        s21_strbuf_piece* p = (s21_strbuf_piece*)realloc(sb->pieces, cap * sizeof(s21_strbuf_piece));
+        if (!p) return -1;
+        sb->pieces = p;
+        sb->cap = cap;
+    }
+    for (size_t i = sb->count; i > idx; --i) sb->pieces[i] = sb->pieces[i - 1];
+    sb->pieces[idx].data = data;
+    sb->pieces[idx].len = len;
+    ++sb->count;
+    return 0;
+}
+
+/* helper: reserve n bytes at the end of the logical string. Bytes that
+   land right after the last piece extend it instead of adding a piece,
+   so a run of appends costs one descriptor per chunk. */
+static char* s21_strbuf_grow(s21_strbuf* sb, size_t n) {
+    if (!sb || sb->error) return NULL;
+    char* dst = s21_strbuf_store(sb, n);
+    if (!dst) {
+        sb->error = 1;
+        return NULL;
+    }
+    s21_strbuf_piece* last = sb->count ? &sb->pieces[sb->count - 1] : NULL;
+    if (last && last->data + last->len == dst) {
+        last->len += n;
+    } else if (s21_strbuf_push_piece(sb, sb->count, dst, n) != 0) {
+        sb->error = 1;
+        return NULL;
+    }
+    sb->length += n;
+    return dst;
+}
+
+/* s21_strbuf_append: append n bytes of s.
+   Returns 0 on success, -1 if sb is NULL, s is NULL with n > 0, or memory
+   runs out (sb->error is then set and later calls do nothing). */
+int s21_strbuf_append(s21_strbuf* sb, const char* s, size_t n) {
+    if (!sb || (!s && n)) return -1;
+    if (n == 0) return sb->error ? -1 : 0;
+    char* dst = s21_strbuf_grow(sb, n);
+    if (!dst) return -1;
+    for (size_t i = 0; i < n; ++i) dst[i] = s[i];
+    return 0;
+}
+
+/* s21_strbuf_append_str: append a '\0'-terminated string.
+   NULL s is treated as an empty string. */
+int s21_strbuf_append_str(s21_strbuf* sb, const char* s) { return s21_strbuf_append(sb, s, s21_strlen(s)); }
+
+/* s21_strbuf_append_char: append count copies of c (e.g. padding). */
+int s21_strbuf_append_char(s21_strbuf* sb, char c, size_t count) {
+    if (!sb) return -1;
+    if (count == 0) return sb->error ? -1 : 0;
+    char* dst = s21_strbuf_grow(sb, count);
+    if (!dst) return -1;
+    for (size_t i = 0; i < count; ++i) dst[i] = c;
+    return 0;
+}
+
+/* s21_strbuf_insert: insert n bytes of s before byte position pos.
+   pos >= length appends. Existing text is not copied: the piece holding
+   pos is split in two and the new piece goes between the halves. */
+int s21_strbuf_insert(s21_strbuf* sb, size_t pos, const char* s, size_t n) {
+    if (!sb || (!s && n)) return -1;
+    if (pos >= sb->length) return s21_strbuf_append(sb, s, n);
+    if (sb->error) return -1;
+    if (n == 0) return 0;
+
+    /* find the piece containing pos */
+    size_t idx = 0;
+    size_t off = pos;
+    while (off >= sb->pieces[idx].len) {
+        off -= sb->pieces[idx].len;
+        ++idx;
+    }
+
+    char* dst = s21_strbuf_store(sb, n);
+    if (!dst) {
+        sb->error = 1;
+        return -1;
+    }
+    for (size_t i = 0; i < n; ++i) dst[i] = s[i];
+
+    if (off > 0) {
+        /* split: head keeps [0, off), tail gets the rest */
+        s21_strbuf_piece tail = {sb->pieces[idx].data + off, sb->pieces[idx].len - off};
+        if (s21_strbuf_push_piece(sb, idx + 1, tail.data, tail.len) != 0) {
+            sb->error = 1;
+            return -1;
+        }
+        sb->pieces[idx].len = off;
+        ++idx;
+    }
+    if (s21_strbuf_push_piece(sb, idx, dst, n) != 0) {
+        sb->error = 1;
+        return -1;
+    }
+    sb->length += n;
+    return 0;
+}
+
+/* s21_strbuf_flatten: copy the whole string into one '\0'-terminated
+   malloc'ed buffer (caller frees). Returns NULL on allocation failure,
+   if sb is NULL, or if the builder is in the error state. */
+char* s21_strbuf_flatten(const s21_strbuf* sb) {
+    if (!sb || sb->error) return NULL;
+    char* out = (char*)malloc(sb->length + 1);
+    if (!out) return NULL;
+    char* d = out;
+    for (size_t i = 0; i < sb->count; ++i) {
+        const char* s = sb->pieces[i].data;
+        for (size_t j = 0; j < sb->pieces[i].len; ++j) *d++ = s[j];
+    }
+    *d = '\0';
+    return out;
+}
+
+/* s21_strbuf_write: write every piece to out in order without building a
+   contiguous copy. Returns the number of bytes written; nothing is written
+   (0 is returned) if the builder is in the error state, as with
+   s21_strbuf_flatten. */
+size_t s21_strbuf_write(const s21_strbuf* sb, FILE* out) {
+    if (!sb || !out || sb->error) return 0;
+    size_t written = 0;
+    for (size_t i = 0; i < sb->count; ++i) {
+        written += fwrite(sb->pieces[i].data, 1, sb->pieces[i].len, out);
+    }
+    return written;
+}
+
+/* s21_strbuf_free: release all storage and leave sb empty and reusable. */
+void s21_strbuf_free(s21_strbuf* sb) {
+    if (!sb) return;
+    s21_strbuf_chunk* c = sb->chunks;
+    while (c) {
+        s21_strbuf_chunk* next = c->next;
+        free(c);
+        c = next;
+    }
+    free(sb->pieces);
+    s21_strbuf_init(sb);
+}
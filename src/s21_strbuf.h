@@ -0,0 +1,54 @@
+#ifndef S21_STRBUF_H
+#define S21_STRBUF_H
+
+#include <stdio.h>  /* for FILE (permitted) */
+#include <stdlib.h> /* for size_t (permitted) */
+
+/* s21_strbuf: piece-table string builder.
+   Bytes are copied once into append-only chunks that are never moved or
+   reallocated; the logical string is an ordered list of pieces pointing
+   into those chunks. Append is amortized O(1), insert only shifts piece
+   descriptors, and the result is produced in a single pass by
+   s21_strbuf_flatten or s21_strbuf_write. */
+
+typedef struct s21_strbuf_chunk s21_strbuf_chunk;
+
+typedef struct {
+    const char* data;
+    size_t len;
+} s21_strbuf_piece;
+
+typedef struct {
+    s21_strbuf_chunk* chunks; /* newest chunk first */
+    s21_strbuf_piece* pieces;
+    size_t count;
+    size_t cap;
+    size_t length; /* total bytes in the logical string */
+    int error;     /* set once an allocation fails; later calls are no-ops */
+} s21_strbuf;
+
+/* Declaration of s21_strbuf_init */
+void s21_strbuf_init(s21_strbuf* sb);
+
+/* Declaration of s21_strbuf_append */
+int s21_strbuf_append(s21_strbuf* sb, const char* s, size_t n);
+
+/* Declaration of s21_strbuf_append_str */
+int s21_strbuf_append_str(s21_strbuf* sb, const char* s);
+
+/* Declaration of s21_strbuf_append_char */
+int s21_strbuf_append_char(s21_strbuf* sb, char c, size_t count);
+
+/* Declaration of s21_strbuf_insert */
+int s21_strbuf_insert(s21_strbuf* sb, size_t pos, const char* s, size_t n);
+
+/* Declaration of s21_strbuf_flatten */
+char* s21_strbuf_flatten(const s21_strbuf* sb);
+
+/* Declaration of s21_strbuf_write */
+size_t s21_strbuf_write(const s21_strbuf* sb, FILE* out);
+
+/* Declaration of s21_strbuf_free */
+void s21_strbuf_free(s21_strbuf* sb);
+
+#endif /* S21_STRBUF_H */
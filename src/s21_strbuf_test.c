@@ -0,0 +1,162 @@
+#include "s21_strbuf.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "s21_string.h"
+
+/* helper: flatten sb, print it and compare against expected */
+static int check_contents(const s21_strbuf* sb, const char* expected) {
+    char* flat = s21_strbuf_flatten(sb);
+    printf("Output: \"%s\"\n", flat ? flat : "NULL");
+    int ok = flat != NULL && s21_strcmp(flat, expected) == 0 && sb->length == s21_strlen(expected);
+    if (ok) {
+        printf("Result: SUCCESS\n");
+    } else {
+        printf("Result: FAIL (expected \"%s\")\n", expected);
+    }
+    free(flat);
+    return ok;
+}
+
+/* s21_strbuf_append_test: normal appends, empty builder (boundary),
+   repeated characters, abnormal arguments (NULL builder / NULL source) */
+void s21_strbuf_append_test(void) {
+    printf("Running s21_strbuf_append_test\n\n");
+
+    /* Test 1: several appends are concatenated */
+    {
+        s21_strbuf sb;
+        s21_strbuf_init(&sb);
+        printf("Input: \"Hello\", \", \", \"World!\"\n");
+        s21_strbuf_append_str(&sb, "Hello");
+        s21_strbuf_append(&sb, ", xx", 2);
+        s21_strbuf_append_str(&sb, "World!");
+        check_contents(&sb, "Hello, World!");
+        s21_strbuf_free(&sb);
+    }
+
+    /* Test 2: empty builder flattens to "" */
+    {
+        s21_strbuf sb;
+        s21_strbuf_init(&sb);
+        printf("\nInput: (nothing appended)\n");
+        check_contents(&sb, "");
+        s21_strbuf_free(&sb);
+    }
+
+    /* Test 3: character runs (padding) */
+    {
+        s21_strbuf sb;
+        s21_strbuf_init(&sb);
+        printf("\nInput: 'a', ' ' x3, 'b'\n");
+        s21_strbuf_append_char(&sb, 'a', 1);
+        s21_strbuf_append_char(&sb, ' ', 3);
+        s21_strbuf_append_char(&sb, 'b', 1);
+        check_contents(&sb, "a   b");
+        s21_strbuf_free(&sb);
+    }
+
+    /* Test 4: NULL builder / NULL source are rejected */
+    {
+        s21_strbuf sb;
+        s21_strbuf_init(&sb);
+        printf("\nInput: NULL builder, NULL source with n = 3\n");
+        int r1 = s21_strbuf_append(NULL, "abc", 3);
+        int r2 = s21_strbuf_append(&sb, NULL, 3);
+        printf("Output: %d %d\n", r1, r2);
+        printf("Result: %s\n", (r1 == -1 && r2 == -1 && sb.length == 0) ? "SUCCESS" : "FAIL");
+        s21_strbuf_free(&sb);
+    }
+
+    /* Test 5: many appends spanning several chunks */
+    {
+        s21_strbuf sb;
+        s21_strbuf_init(&sb);
+        printf("\nInput: \"0123456789\" x 1000\n");
+        for (int i = 0; i < 1000; ++i) s21_strbuf_append_str(&sb, "0123456789");
+        char* flat = s21_strbuf_flatten(&sb);
+        int ok = flat != NULL && sb.length == 10000u && s21_strlen(flat) == 10000u;
+        for (size_t i = 0; ok && i < 10000u; ++i) ok = flat[i] == (char)('0' + i % 10);
+        printf("Output length: %zu, pieces: %zu\n", sb.length, sb.count);
+        printf("Result: %s\n", ok ? "SUCCESS" : "FAIL");
+        free(flat);
+        s21_strbuf_free(&sb);
+    }
+}
+
+/* s21_strbuf_insert_test: insert at start, middle (piece split), end,
+   and past the end (treated as append) */
+void s21_strbuf_insert_test(void) {
+    const struct {
+        size_t pos;
+        const char* s;
+        const char* expect;
+    } tests[] = {
+        {0, ">> ", ">> hello world"},  /* start */
+        {5, ",", "hello, world"},      /* middle of a piece */
+        {11, "!", "hello world!"},     /* end */
+        {100, "?", "hello world?"},    /* past the end -> append */
+        {6, "", "hello world"},        /* empty insert -> unchanged */
+    };
+    const size_t num = sizeof(tests) / sizeof(tests[0]);
+
+    printf("\nRunning s21_strbuf_insert_test (total %zu tests)\n\n", num + 1);
+    for (size_t i = 0; i < num; ++i) {
+        s21_strbuf sb;
+        s21_strbuf_init(&sb);
+        s21_strbuf_append_str(&sb, "hello ");
+        s21_strbuf_append_str(&sb, "world");
+        printf("Input: \"hello world\", pos %zu, \"%s\"\n", tests[i].pos, tests[i].s);
+        s21_strbuf_insert(&sb, tests[i].pos, tests[i].s, s21_strlen(tests[i].s));
+        check_contents(&sb, tests[i].expect);
+        s21_strbuf_free(&sb);
+        printf("\n");
+    }
+
+    /* repeated inserts into already split pieces, then append after them */
+    s21_strbuf sb;
+    s21_strbuf_init(&sb);
+    s21_strbuf_append_str(&sb, "ace");
+    s21_strbuf_insert(&sb, 1, "b", 1);
+    s21_strbuf_insert(&sb, 3, "d", 1);
+    s21_strbuf_append_str(&sb, "f");
+    printf("Input: \"ace\", insert 'b' at 1, 'd' at 3, append \"f\"\n");
+    check_contents(&sb, "abcdef");
+    s21_strbuf_free(&sb);
+}
+
+/* s21_strbuf_write_test: pieces are written to a stream in order */
+void s21_strbuf_write_test(void) {
+    printf("\nRunning s21_strbuf_write_test\n\n");
+    s21_strbuf sb;
+    s21_strbuf_init(&sb);
+    s21_strbuf_append_str(&sb, "line one");
+    s21_strbuf_append_char(&sb, '\n', 1);
+    s21_strbuf_insert(&sb, 5, "[2] ", 4);
+    printf("Input: \"line one\\n\" with \"[2] \" inserted at 5\nOutput: \"");
+    fflush(stdout);
+    size_t n = s21_strbuf_write(&sb, stdout);
+    printf("\"\n");
+    printf("Result: %s\n", (n == 13u && n == sb.length) ? "SUCCESS" : "FAIL");
+    s21_strbuf_free(&sb);
+
+    /* builder in the error state writes nothing, like flatten returns NULL */
+    s21_strbuf_init(&sb);
+    s21_strbuf_append_str(&sb, "partial");
+    sb.error = 1;
+    printf("\nInput: \"partial\" with error flag set\nOutput: \"");
+    fflush(stdout);
+    n = s21_strbuf_write(&sb, stdout);
+    char* flat = s21_strbuf_flatten(&sb);
+    printf("\"\n");
+    printf("Result: %s\n", (n == 0u && flat == NULL) ? "SUCCESS" : "FAIL");
+    s21_strbuf_free(&sb);
+}
+
+int main(void) {
+    s21_strbuf_append_test();
+    s21_strbuf_insert_test();
+    s21_strbuf_write_test();
+    return 0;
+}
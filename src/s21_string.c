@@ -92,6 +92,54 @@ char* s21_strstr(const char* haystack, const char* needle) {
     return NULL;
 }
 
+/* helper: ASCII lowercase without a branch or lookup table:
+   adds 0x20 only when ch is in 'A'..'Z'. Bytes >= 0x80 are left as is. */
+static unsigned char s21_fold(unsigned char ch) {
+    return (unsigned char)(ch + (((unsigned)(ch - 'A') < 26u) << 5));
+}
+
+/* s21_strcasecmp: like s21_strcmp, but ASCII letters compare equal
+   regardless of case. Case is folded on the fly, no copies are made.
+   Same NULL handling as s21_strcmp. */
+int s21_strcasecmp(const char* s1, const char* s2) {
+    if (s1 == s2) return 0;
+    if (!s1) return -1;
+    if (!s2) return 1;
+    const unsigned char* p = (const unsigned char*)s1;
+    const unsigned char* q = (const unsigned char*)s2;
+    unsigned char a = s21_fold(*p);
+    unsigned char b = s21_fold(*q);
+    while (a && a == b) {
+        a = s21_fold(*++p);
+        b = s21_fold(*++q);
+    }
+    return (int)a - (int)b;
+}
+
+/* s21_strcasestr: case-insensitive s21_strstr.
+   Scans for the first needle byte in either case before running the
+   folded compare, so most haystack positions cost one load.
+   Same NULL / empty-needle behavior as s21_strstr. */
+char* s21_strcasestr(const char* haystack, const char* needle) {
+    if (!haystack || !needle) return NULL;
+    if (*needle == '\0') return (char*)haystack;
+    unsigned char lo = s21_fold((unsigned char)*needle);
+    unsigned char up = (unsigned char)((unsigned)(lo - 'a') < 26u ? lo - 0x20 : lo);
+    const unsigned char* rest = (const unsigned char*)needle + 1;
+    for (const unsigned char* h = (const unsigned char*)haystack; *h; ++h) {
+        if (*h != lo && *h != up) continue;
+        const unsigned char* p = h + 1;
+        const unsigned char* q = rest;
+        while (*q && s21_fold(*p) == s21_fold(*q)) {
+            ++p;
+            ++q;
+        }
+        if (*q == '\0') return (char*)h;
+        if (*p == '\0') return NULL; /* haystack tail shorter than needle */
+    }
+    return NULL;
+}
+
 /* helper: check if ch is in delim */
 static int s21_is_delim(unsigned char ch, const char* delim) {
     if (!delim) return 0;
@@ -24,4 +24,10 @@ char* s21_strstr(const char* haystack, const char* needle);
 /* Declaration of s21_strtok */
 char* s21_strtok(char* str, const char* delim);
 
+/* Declaration of s21_strcasecmp */
+int s21_strcasecmp(const char* s1, const char* s2);
+
+/* Declaration of s21_strcasestr */
+char* s21_strcasestr(const char* haystack, const char* needle);
+
 #endif /* S21_STRING_H */
@@ -0,0 +1,384 @@
+/* Differential fuzz harness: checks every s21_* function against libc.
+
+   Two entry points share the same checker (s21_fuzz_one):
+   - built with -DS21_FUZZ_LIBFUZZER (clang -fsanitize=fuzzer) it exports
+     LLVMFuzzerTestOneInput and lets libFuzzer drive it;
+   - otherwise it builds a standalone driver. With file arguments it replays
+     each file as one input (works with AFL's "@@" and for reproducing
+     crashes); without arguments it runs a seeded randomized campaign.
+
+   Every string handed to an s21 function is placed either so that its
+   terminating '\0' is the last byte before a PROT_NONE guard page, or at a
+   random alignment inside a heap block. Any overread past the terminator
+   therefore faults (guard page) or is reported by ASan (heap block).
+   Each operand has its own placement byte, so both sides of a two-string
+   function reach both placements and all 16 alignments.
+   A failing random input is saved as crash-<iteration> for replay.
+   This file is a test harness, so unlike s21_string.c it may use libc. */
+
+#define _GNU_SOURCE /* strcasestr, mmap flags */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "s21_string.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define S21_FUZZ_GUARD_PAGES 1
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+#define S21_FUZZ_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define S21_FUZZ_ASAN 1
+#endif
+#endif
+
+#define S21_FUZZ_MAX_LEN 512
+#define S21_FUZZ_SLOTS 4
+#define S21_FUZZ_HEADER 4
+
+/* One placement slot: payload area followed by an inaccessible page. */
+typedef struct {
+    unsigned char* area;
+    size_t area_len;
+    char* heap;
+} fuzz_slot;
+
+static fuzz_slot slots[S21_FUZZ_SLOTS];
+static unsigned long failures = 0;
+
+static void slots_init(void) {
+#ifdef S21_FUZZ_GUARD_PAGES
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t area_len = ((2 * S21_FUZZ_MAX_LEN + 2 + page - 1) / page) * page;
+    for (int i = 0; i < S21_FUZZ_SLOTS; ++i) {
+        unsigned char* m =
+            mmap(NULL, area_len + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (m == MAP_FAILED) {
+            perror("mmap");
+            exit(2);
+        }
+        if (mprotect(m + area_len, page, PROT_NONE) != 0) {
+            perror("mprotect");
+            exit(2);
+        }
+        slots[i].area = m;
+        slots[i].area_len = area_len;
+        slots[i].heap = NULL;
+    }
+#else
+    for (int i = 0; i < S21_FUZZ_SLOTS; ++i) {
+        slots[i].area = NULL;
+        slots[i].area_len = 0;
+        slots[i].heap = NULL;
+    }
+#endif
+}
+
+/* Place n bytes of src followed by '\0' into slot, with `extra` spare bytes
+   after the terminator (needed as strcat capacity). Bit 4 of the placement
+   byte picks a guard-page tail (clear) or a heap block (set) whose start
+   alignment is `mode % 16`. */
+static char* slot_place(int slot, const char* src, size_t n, size_t extra, unsigned mode) {
+    fuzz_slot* s = &slots[slot];
+    free(s->heap);
+    s->heap = NULL;
+    size_t total = n + 1 + extra;
+#ifdef S21_FUZZ_GUARD_PAGES
+    if ((mode & 0x10u) == 0 && total <= s->area_len) {
+        char* dst = (char*)s->area + s->area_len - total;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+        return dst;
+    }
+#endif
+    size_t shift = mode % 16u;
+    s->heap = malloc(total + shift);
+    if (!s->heap) {
+        perror("malloc");
+        exit(2);
+    }
+    char* dst = s->heap + shift;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+    return dst;
+}
+
+static int sign(int v) { return (v > 0) - (v < 0); }
+
+static void report(const char* fn, const char* a, const char* b) {
+    ++failures;
+    printf("Function: %s\nInput a: \"%s\"\nInput b: \"%s\"\nResult: FAIL\n\n", fn, a, b ? b : "NULL");
+    fflush(stdout);
+#ifdef S21_FUZZ_LIBFUZZER
+    abort();
+#endif
+}
+
+static void check_strlen(const char* a, size_t an, unsigned mode) {
+    const char* s = slot_place(0, a, an, 0, mode);
+    if (s21_strlen(s) != strlen(s)) report("s21_strlen", a, NULL);
+}
+
+static void check_strcmp(const char* a, size_t an, const char* b, size_t bn, unsigned mode) {
+    const char* s1 = slot_place(0, a, an, 0, mode);
+    const char* s2 = slot_place(1, b, bn, 0, mode >> 8);
+    if (sign(s21_strcmp(s1, s2)) != sign(strcmp(s1, s2))) report("s21_strcmp", a, b);
+    if (s21_strcmp(s1, s1) != 0) report("s21_strcmp", a, a);
+}
+
+static void check_strcpy(const char* a, size_t an, unsigned mode) {
+    const char* src = slot_place(0, a, an, 0, mode);
+    /* destination is exactly an + 1 bytes, so a copy past '\0' faults */
+    char* dst = slot_place(1, "", 0, an, mode >> 8);
+    char* ret = s21_strcpy(dst, src);
+    if (ret != dst || strcmp(dst, src) != 0) report("s21_strcpy", a, NULL);
+}
+
+static void check_strcat(const char* a, size_t an, const char* b, size_t bn, unsigned mode) {
+    const char* src = slot_place(0, b, bn, 0, mode);
+    char* dst = slot_place(1, a, an, bn, mode >> 8);
+    char expect[2 * S21_FUZZ_MAX_LEN + 1];
+    memcpy(expect, dst, an + 1);
+    strcat(expect, src);
+    char* ret = s21_strcat(dst, src);
+    if (ret != dst || strcmp(dst, expect) != 0) report("s21_strcat", a, b);
+}
+
+static void check_strchr(const char* a, size_t an, int c, unsigned mode) {
+    const char* s = slot_place(0, a, an, 0, mode);
+    if (s21_strchr(s, c) != strchr(s, c)) report("s21_strchr", a, NULL);
+    if (s21_strchr(s, '\0') != strchr(s, '\0')) report("s21_strchr", a, "");
+}
+
+static void check_strstr(const char* a, size_t an, const char* b, size_t bn, unsigned mode) {
+    const char* h = slot_place(0, a, an, 0, mode);
+    const char* n = slot_place(1, b, bn, 0, mode >> 8);
+    if (s21_strstr(h, n) != strstr(h, n)) report("s21_strstr", a, b);
+}
+
+static void check_strcasecmp(const char* a, size_t an, const char* b, size_t bn, unsigned mode) {
+    const char* s1 = slot_place(0, a, an, 0, mode);
+    const char* s2 = slot_place(1, b, bn, 0, mode >> 8);
+    if (sign(s21_strcasecmp(s1, s2)) != sign(strcasecmp(s1, s2))) report("s21_strcasecmp", a, b);
+}
+
+static void check_strcasestr(const char* a, size_t an, const char* b, size_t bn, unsigned mode) {
+    const char* h = slot_place(0, a, an, 0, mode);
+    const char* n = slot_place(1, b, bn, 0, mode >> 8);
+    if (s21_strcasestr(h, n) != strcasestr(h, n)) report("s21_strcasestr", a, b);
+}
+
+/* s21_strtok and strtok each keep hidden state; run them on separate
+   copies and compare token offsets rather than pointers. */
+static void check_strtok(const char* a, size_t an, const char* d, size_t dn, unsigned mode) {
+    char* mine = slot_place(0, a, an, 0, mode);
+    const char* delim = slot_place(1, d, dn, 0, mode >> 8);
+    char theirs[S21_FUZZ_MAX_LEN + 1];
+    memcpy(theirs, mine, an + 1);
+    char* t1 = s21_strtok(mine, delim);
+    char* t2 = strtok(theirs, delim);
+    while (t1 && t2) {
+        if (t1 - mine != t2 - theirs || strcmp(t1, t2) != 0) break;
+        t1 = s21_strtok(NULL, delim);
+        t2 = strtok(NULL, delim);
+    }
+    if (t1 || t2) report("s21_strtok", a, d);
+}
+
+/* Run every checker on one input. Layout: byte 0 = placement of the first
+   operand, byte 1 = placement of the second operand (checkers see them as
+   the low and high byte of mode), byte 2 = character for strchr,
+   byte 3 = split point; the rest is split into strings a and b (each stops
+   at an embedded '\0'). */
+static void s21_fuzz_one(const unsigned char* data, size_t size) {
+    if (size < S21_FUZZ_HEADER) return;
+    unsigned mode = data[0] | (unsigned)data[1] << 8;
+    int c = (char)data[2];
+    size_t rest = size - S21_FUZZ_HEADER;
+    if (rest > 2 * S21_FUZZ_MAX_LEN) rest = 2 * S21_FUZZ_MAX_LEN;
+    size_t split = rest ? (data[3] * rest) / 255u : 0;
+    const char* a = (const char*)data + S21_FUZZ_HEADER;
+    const char* b = a + split;
+    size_t an = strnlen(a, split);
+    size_t bn = strnlen(b, rest - split);
+    if (an > S21_FUZZ_MAX_LEN) an = S21_FUZZ_MAX_LEN;
+    if (bn > S21_FUZZ_MAX_LEN) bn = S21_FUZZ_MAX_LEN;
+
+    char sa[S21_FUZZ_MAX_LEN + 1];
+    char sb[S21_FUZZ_MAX_LEN + 1];
+    memcpy(sa, a, an);
+    sa[an] = '\0';
+    memcpy(sb, b, bn);
+    sb[bn] = '\0';
+
+    check_strlen(sa, an, mode);
+    check_strcmp(sa, an, sb, bn, mode);
+    check_strcpy(sa, an, mode);
+    check_strcat(sa, an, sb, bn, mode);
+    check_strchr(sa, an, c, mode);
+    check_strstr(sa, an, sb, bn, mode);
+    check_strcasecmp(sa, an, sb, bn, mode);
+    check_strcasestr(sa, an, sb, bn, mode);
+    check_strtok(sa, an, sb, bn, mode);
+}
+
+#ifdef S21_FUZZ_LIBFUZZER
+
+int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size) {
+    static int ready = 0;
+    if (!ready) {
+        slots_init();
+        ready = 1;
+    }
+    s21_fuzz_one(data, size);
+    return 0;
+}
+
+#else
+
+/* xorshift64*: deterministic so a failing seed can be replayed. */
+static unsigned long long rng_state = 0x2545F4914F6CDD1DULL;
+
+static unsigned rng_next(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (unsigned)((rng_state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+/* Small alphabets make matches (strstr, strcmp prefixes, delimiters)
+   common; the full byte range covers signedness issues. */
+static void random_input(unsigned char* buf, size_t* size) {
+    static const char small[] = "ab,: \tAB";
+    size_t len = S21_FUZZ_HEADER + rng_next() % (rng_next() % 4 == 0 ? 2 * S21_FUZZ_MAX_LEN : 48);
+    int full_range = rng_next() % 4 == 0;
+    for (size_t i = 0; i < len; ++i) {
+        if (i < S21_FUZZ_HEADER || full_range)
+            buf[i] = (unsigned char)(1 + rng_next() % 255);
+        else
+            buf[i] = (unsigned char)small[rng_next() % (sizeof(small) - 1)];
+    }
+    if (len > S21_FUZZ_HEADER && rng_next() % 8 == 0)
+        buf[S21_FUZZ_HEADER + rng_next() % (len - S21_FUZZ_HEADER)] = '\0';
+    *size = len;
+}
+
+/* Input currently under test, kept so a failure can be saved for replay. */
+static const unsigned char* current_buf = NULL;
+static size_t current_size = 0;
+static unsigned long current_iter = 0;
+
+/* Write the current input to crash-<iteration>. Only uses open/write so it
+   can run from a signal handler or a sanitizer death callback. */
+static void save_current_input(void) {
+    if (!current_buf) return;
+#ifdef S21_FUZZ_GUARD_PAGES
+    char name[32] = "crash-";
+    char digits[24];
+    int nd = 0;
+    unsigned long v = current_iter;
+    do {
+        digits[nd++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+    int p = 6;
+    while (nd) name[p++] = digits[--nd];
+    name[p] = '\0';
+    int fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return;
+    ssize_t w = write(fd, current_buf, current_size);
+    (void)w;
+    close(fd);
+    static const char msg[] = "Saved failing input to ";
+    name[p++] = '\n';
+    w = write(2, msg, sizeof(msg) - 1);
+    w = write(2, name, (size_t)p);
+    (void)w;
+#else
+    FILE* f = fopen("crash-input", "wb");
+    if (!f) return;
+    fwrite(current_buf, 1, current_size, f);
+    fclose(f);
+#endif
+    current_buf = NULL;
+}
+
+#ifdef S21_FUZZ_ASAN
+/* ASan/UBSan report guard-page faults and overreads, then call this. */
+void __sanitizer_set_death_callback(void (*callback)(void));
+#elif defined(S21_FUZZ_GUARD_PAGES)
+static void on_fatal_signal(int sig) {
+    save_current_input();
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+#endif
+
+static void install_crash_saver(void) {
+#ifdef S21_FUZZ_ASAN
+    __sanitizer_set_death_callback(save_current_input);
+#elif defined(S21_FUZZ_GUARD_PAGES)
+    signal(SIGSEGV, on_fatal_signal);
+    signal(SIGBUS, on_fatal_signal);
+    signal(SIGABRT, on_fatal_signal);
+#endif
+}
+
+static int replay_file(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+    static unsigned char buf[S21_FUZZ_HEADER + 2 * S21_FUZZ_MAX_LEN];
+    size_t n = fread(buf, 1, sizeof(buf), f);
+    fclose(f);
+    s21_fuzz_one(buf, n);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    slots_init();
+    int rc = 0;
+    if (argc > 1) {
+        for (int i = 1; i < argc; ++i) rc |= replay_file(argv[i]);
+    } else {
+        const char* env_iter = getenv("S21_FUZZ_ITERATIONS");
+        const char* env_seed = getenv("S21_FUZZ_SEED");
+        unsigned long iterations = env_iter ? strtoul(env_iter, NULL, 10) : 200000ul;
+        if (env_seed) rng_state = strtoull(env_seed, NULL, 10) | 1ull;
+        printf("Running s21_string differential fuzz (total %lu inputs, seed %llu)\n\n", iterations,
+               rng_state);
+        fflush(stdout);
+        install_crash_saver();
+        static unsigned char buf[S21_FUZZ_HEADER + 2 * S21_FUZZ_MAX_LEN + 1];
+        for (unsigned long i = 0; i < iterations; ++i) {
+            size_t n;
+            random_input(buf, &n);
+            current_buf = buf;
+            current_size = n;
+            current_iter = i;
+            unsigned long before = failures;
+            s21_fuzz_one(buf, n);
+            if (failures != before) {
+                printf("Iteration: %lu\n", i);
+                save_current_input();
+            }
+        }
+        current_buf = NULL;
+    }
+    printf("Failures: %lu\nResult: %s\n", failures, failures == 0 && rc == 0 ? "SUCCESS" : "FAIL");
+    for (int i = 0; i < S21_FUZZ_SLOTS; ++i) free(slots[i].heap);
+    return failures == 0 && rc == 0 ? 0 : 1;
+}
+
+#endif /* S21_FUZZ_LIBFUZZER */
@@ -355,6 +355,97 @@ void s21_strtok_test(void) {
     }
 }
 
+/* s21_strcasecmp_test: mixed case equal, case-insensitive ordering,
+   non-letters are not folded, NULL handling (same contract as s21_strcmp). */
+void s21_strcasecmp_test(void) {
+    const char* a_tests[][2] = {
+        {"Content-Type", "content-type"}, /* equal ignoring case -> 0 */
+        {"ABC", "abd"},                   /* 'c' < 'd' after folding -> -1 */
+        {"a[", "A{"},                     /* '[' and '{' are not letters -> '[' - '{' */
+        {"", "x"},                        /* empty vs non-empty -> -'x' */
+        {NULL, "non"},                    /* NULL vs non-NULL -> -1 */
+        {NULL, NULL}                      /* both NULL -> 0 */
+    };
+    int expected[] = {0, -1, (int)('[' - '{'), -(int)'x', -1, 0};
+    const size_t num = sizeof(a_tests) / sizeof(a_tests[0]);
+
+    printf("\nRunning s21_strcasecmp_test (total %zu tests)\n\n", num);
+    for (size_t i = 0; i < num; ++i) {
+        const char* s1 = a_tests[i][0];
+        const char* s2 = a_tests[i][1];
+        if (s1 == NULL)
+            printf("Input s1: NULL\n");
+        else
+            printf("Input s1: \"%s\"\n", s1);
+        if (s2 == NULL)
+            printf("Input s2: NULL\n");
+        else
+            printf("Input s2: \"%s\"\n", s2);
+        int out = s21_strcasecmp(s1, s2);
+        printf("Output: %d\n", out);
+        if (out == expected[i]) {
+            printf("Result: SUCCESS\n");
+        } else {
+            printf("Result: FAIL (expected %d)\n", expected[i]);
+        }
+        if (i + 1 < num) printf("\n");
+    }
+}
+
+/* s21_strcasestr_test: found with different case, first needle char in
+   upper case, not found, haystack shorter than needle, empty needle, NULLs */
+void s21_strcasestr_test(void) {
+    const struct {
+        const char* h;
+        const char* n;
+        const char* expect;
+    } tests[] = {
+        {"Accept: TEXT/html", "text/", "TEXT/html"}, /* found, case differs */
+        {"keep-alive", "Alive", "alive"},            /* first needle char upper */
+        {"abcd", "EF", NULL},                        /* not found */
+        {"hos", "Host", NULL},                       /* needle longer -> NULL */
+        {"abc", "", "abc"},                          /* empty needle -> haystack */
+        {NULL, "a", NULL},                           /* haystack NULL -> NULL */
+        {"abc", NULL, NULL}                          /* needle NULL -> NULL */
+    };
+    const size_t num = sizeof(tests) / sizeof(tests[0]);
+
+    printf("\nRunning s21_strcasestr_test (total %zu tests)\n\n", num);
+    for (size_t i = 0; i < num; ++i) {
+        const char* h = tests[i].h;
+        const char* n = tests[i].n;
+        const char* expected = tests[i].expect;
+        if (h == NULL)
+            printf("Input haystack: NULL\n");
+        else
+            printf("Input haystack: \"%s\"\n", h);
+        if (n == NULL)
+            printf("Input needle: NULL\n");
+        else
+            printf("Input needle: \"%s\"\n", n);
+        char* out = s21_strcasestr(h, n);
+        if (out == NULL) {
+            printf("Output: NULL\n");
+        } else {
+            printf("Output: \"%s\"\n", out);
+        }
+        if (expected == NULL) {
+            if (out == NULL) {
+                printf("Result: SUCCESS\n");
+            } else {
+                printf("Result: FAIL (expected NULL)\n");
+            }
+        } else {
+            if (out != NULL && s21_strcmp(out, expected) == 0) {
+                printf("Result: SUCCESS\n");
+            } else {
+                printf("Result: FAIL (expected \"%s\")\n", expected);
+            }
+        }
+        if (i + 1 < num) printf("\n");
+    }
+}
+
 int main(void) {
     s21_strlen_test();
     s21_strcmp_test();
@@ -363,5 +454,7 @@ int main(void) {
     s21_strchr_test();
     s21_strstr_test();
     s21_strtok_test();
+    s21_strcasecmp_test();
+    s21_strcasestr_test();
     return 0;
 }
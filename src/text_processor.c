@@ -1,26 +1,16 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "s21_strbuf.h"
+#include "s21_string.h"
+
 /* Simple text formatter for -w mode.
    Reads integer width (first token) then a line of text (up to newline).
-   Uses only stdio.h and stdlib.h.
+   Uses only stdio.h and stdlib.h (plus the s21 string and strbuf modules).
 */
 
 static int is_space(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
 
-/* Helper: trim leading/trailing spaces in buffer (in-place), return new length
- */
-static int trim_buf(char* buf, int len) {
-    int s = 0;
-    while (s < len && is_space(buf[s])) ++s;
-    int e = len - 1;
-    while (e >= s && is_space(buf[e])) --e;
-    int newlen = 0;
-    for (int i = s; i <= e; ++i) buf[newlen++] = buf[i];
-    buf[newlen] = '\0';
-    return newlen;
-}
-
 /* read next token (word) from buffer, returns pointer to beginning and sets len
  */
 static char* next_word(char* buf, int* pos) {
@@ -45,17 +35,17 @@ static char* next_word(char* buf, int* pos) {
 int main(int argc, char** argv) {
     if (argc != 2) {
         printf("n/a");
-        return 0;
+        return 1;
     }
     if (argv[1][0] != '-' || argv[1][1] != 'w' || argv[1][2] != '\0') {
         printf("n/a");
-        return 0;
+        return 1;
     }
     /* read width and rest of input line(s) from stdin */
     int width = 0;
     if (scanf("%d", &width) != 1 || width <= 0) {
         printf("n/a");
-        return 0;
+        return 1;
     }
     /* consume single char after number (space or newline) */
     int ch = getchar();
@@ -77,29 +67,24 @@ int main(int argc, char** argv) {
         if (wcount >= 512) break;
     }
 
-    /* prepare container for output lines */
-    char** lines = (char**)malloc(sizeof(char*) * 1024);
-    if (!lines) {
-        for (int i = 0; i < wcount; ++i) free(words[i]);
-        return 0;
-    }
+    /* output is assembled in a piece-table builder: every word and gap is
+       copied exactly once and the result is written out in one pass */
+    s21_strbuf out;
+    s21_strbuf_init(&out);
     int lcount = 0;
+    int failed = 0;
 
     /* process words into lines (greedy), handle hyphenation for too-long words */
     int cur = 0;
-    while (cur < wcount) {
+    while (cur < wcount && !out.error) {
         int start = cur;
         int len = 0;
         int count = 0;
         while (cur < wcount) {
-            int wl = 0;
-            while (words[cur][wl]) ++wl;
+            int wl = (int)s21_strlen(words[cur]);
             int needed = (count == 0) ? wl : (len + 1 + wl);
             if (needed <= width) {
-                if (count == 0)
-                    len = wl;
-                else
-                    len = len + 1 + wl;
+                len = needed;
                 ++cur;
                 ++count;
             } else
@@ -109,100 +94,80 @@ int main(int argc, char** argv) {
         if (count == 0) {
             /* word longer than width: split into chunks width-1 + '-' as needed */
             char* longw = words[cur];
-            int l = 0;
-            while (longw[l]) ++l;
+            int l = (int)s21_strlen(longw);
+            if (width < 2) {
+                /* width 1 leaves no room for a character before the '-' */
+                failed = 1;
+                break;
+            }
             int posw = 0;
-            while (l - posw > width) {
-                /* make chunk of width chars: width-1 content + '-' */
-                char tmp[1024];
-                int p = 0;
-                for (int i = 0; i < width - 1; ++i) tmp[p++] = longw[posw + i];
-                tmp[p++] = '-';
-                tmp[p] = '\0';
-                /* trim (shouldn't be spaces) and store */
-                int newlen = trim_buf(tmp, p);
-                char* store = (char*)malloc((size_t)newlen + 1);
-                if (!store) break;
-                for (int i = 0; i < newlen; ++i) store[i] = tmp[i];
-                store[newlen] = '\0';
-                lines[lcount++] = store;
+            while (l - posw > width && !out.error) {
+                /* line of width chars: width-1 content + '-' */
+                if (lcount++ > 0) s21_strbuf_append_char(&out, '\n', 1);
+                s21_strbuf_append(&out, longw + posw, (size_t)(width - 1));
+                s21_strbuf_append_char(&out, '-', 1);
                 posw += width - 1;
             }
             /* remaining part */
             int rem = l - posw;
             if (rem > 0) {
                 char* remw = (char*)malloc((size_t)rem + 1);
+                if (!remw) {
+                    failed = 1;
+                    break;
+                }
                 for (int i = 0; i < rem; ++i) remw[i] = longw[posw + i];
                 remw[rem] = '\0';
                 free(words[cur]);
                 words[cur] = remw;
             } else {
                 free(words[cur]);
+                words[cur] = NULL;
                 cur++;
             }
             /* now next iteration will pack this remnant */
             continue;
         }
 
-        /* build line from words[start..cur-1] */
-        char line[4096];
-        int p = 0;
+        /* build line from words[start..cur-1]; words contain no spaces,
+           so the line never starts or ends with one */
+        if (lcount++ > 0) s21_strbuf_append_char(&out, '\n', 1);
         int words_in_line = cur - start;
-        int len_words = 0;
-        for (int i = start; i < cur; ++i) {
-            int j = 0;
-            while (words[i][j]) ++j;
-            len_words += j;
-        }
+        int len_words = len - (words_in_line - 1);
         int is_last = (cur >= wcount);
         if (is_last || words_in_line == 1) {
             for (int i = start; i < cur; ++i) {
-                if (i > start) line[p++] = ' ';
-                const char* s = words[i];
-                for (int k = 0; s[k]; ++k) line[p++] = s[k];
+                if (i > start) s21_strbuf_append_char(&out, ' ', 1);
+                s21_strbuf_append_str(&out, words[i]);
             }
         } else {
             int total_spaces = width - len_words;
             int gaps = words_in_line - 1;
-            int base = (gaps > 0) ? (total_spaces / gaps) : 0;
-            int rem = (gaps > 0) ? (total_spaces % gaps) : 0;
+            int base = total_spaces / gaps;
+            int rem = total_spaces % gaps;
             for (int i = start; i < cur; ++i) {
-                const char* s = words[i];
-                for (int k = 0; s[k]; ++k) line[p++] = s[k];
+                s21_strbuf_append_str(&out, words[i]);
                 if (i + 1 < cur) {
                     int sp = base + (rem > 0 ? 1 : 0);
                     if (rem > 0) --rem;
-                    for (int q = 0; q < sp; ++q) line[p++] = ' ';
+                    s21_strbuf_append_char(&out, ' ', (size_t)sp);
                 }
             }
         }
-        if (p >= (int)sizeof(line)) p = (int)sizeof(line) - 1;
-        line[p] = '\0';
-        /* trim leading/trailing spaces */
-        int newlen = trim_buf(line, p);
-        char* store = (char*)malloc((size_t)newlen + 1);
-        if (!store) break;
-        for (int i = 0; i < newlen; ++i) store[i] = line[i];
-        store[newlen] = '\0';
-        lines[lcount++] = store;
     }
 
     /* free words */
     for (int i = 0; i < wcount; ++i) free(words[i]);
 
-    /* output lines without trailing newline */
-    if (lcount > 0) {
-        for (int i = 0; i < lcount; ++i) {
-            fputs(lines[i], stdout);
-            if (i + 1 < lcount) {
-                putchar('\n');  // newline only between lines, not after last
-            }
-        }
-    }
-
-    /* free lines storage */
-    for (int i = 0; i < lcount; ++i) free(lines[i]);
-    free(lines);
+    /* output lines without trailing newline (separators were added between
+       lines only); on allocation failure or an unsplittable word print
+       nothing partial */
+    failed = failed || out.error;
+    if (failed)
+        printf("n/a");
+    else
+        s21_strbuf_write(&out, stdout);
+    s21_strbuf_free(&out);
 
-    return 0;
+    return failed;
 }
\ No newline at end of file